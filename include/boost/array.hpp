@@ -46,10 +46,143 @@
 #include <boost/assert.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 #include <utility>
 #include <cstddef>
+#include <cstring>
+
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && !BOOST_WORKAROUND(BOOST_LIBSTDCXX_VERSION, < 50000)
+# include <type_traits>
+# define BOOST_ARRAY_HAS_TYPE_TRAITS
+#endif
+
+// BOOST_ARRAY_IS_CONSTANT_EVALUATED() detects constant evaluation, so that
+// the element loops below can be replaced with the corresponding <cstring>
+// functions at run time. When the functions aren't constexpr to begin with
+// (no C++14 constexpr), it's false; when detection isn't possible, it's
+// true and the portable loops remain in use.
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+# define BOOST_ARRAY_IS_CONSTANT_EVALUATED() false
+#endif
+
+#if !defined(BOOST_ARRAY_IS_CONSTANT_EVALUATED) && defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#  define BOOST_ARRAY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# endif
+#endif
+
+#if !defined(BOOST_ARRAY_IS_CONSTANT_EVALUATED)
+# if defined(BOOST_GCC) && BOOST_GCC >= 90000
+#  define BOOST_ARRAY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# elif defined(BOOST_MSVC) && BOOST_MSVC >= 1925
+#  define BOOST_ARRAY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+# else
+#  define BOOST_ARRAY_IS_CONSTANT_EVALUATED() true
+# endif
+#endif
+
+// BOOST_ARRAY_UNROLL requests (bounded) unrolling of the loop that
+// follows. The trip counts here are compile-time constants, so for small
+// N this removes the loop control overhead entirely; the bound keeps the
+// code size of large instantiations in check.
+
+#if defined(BOOST_CLANG)
+# define BOOST_ARRAY_UNROLL _Pragma("clang loop unroll_count(16)")
+#elif defined(BOOST_GCC) && BOOST_GCC >= 80000
+# define BOOST_ARRAY_UNROLL _Pragma("GCC unroll 16")
+#else
+# define BOOST_ARRAY_UNROLL
+#endif
+
+// std::reverse_iterator operations are constexpr starting with C++17;
+// __cpp_lib_array_constexpr tracks that
+
+#if defined(__cpp_lib_array_constexpr) && __cpp_lib_array_constexpr >= 201603L
+# define BOOST_ARRAY_CONSTEXPR17 constexpr
+#else
+# define BOOST_ARRAY_CONSTEXPR17
+#endif
+
+// BOOST_ARRAY_PREFETCH(p) requests a prefetch of the cache line at p,
+// keeping a streaming loop ahead of the demand misses. A prefetch of an
+// address past the end of the object is permitted and has no effect.
+
+#if defined(BOOST_CLANG) || defined(BOOST_GCC)
+# define BOOST_ARRAY_PREFETCH(p) __builtin_prefetch(p)
+#else
+# define BOOST_ARRAY_PREFETCH(p) ((void)0)
+#endif
+
+// BOOST_ATTRIBUTE_NODISCARD can expand to [[nodiscard]] even in C++03
+// mode, where the attribute syntax is only a (warning-generating)
+// extension; restrict it to C++11 and later
+
+#if __cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L)
+# define BOOST_ARRAY_NODISCARD BOOST_ATTRIBUTE_NODISCARD
+#else
+# define BOOST_ARRAY_NODISCARD
+#endif
+
+// BOOST_ARRAY_MEMCMP is __builtin_memcmp where available; with the
+// size a compile-time constant, the compilers expand small comparisons
+// inline (wide loads, xor, test) instead of calling into libc.
+
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_memcmp)
+#  define BOOST_ARRAY_MEMCMP __builtin_memcmp
+# endif
+#endif
+
+#if !defined(BOOST_ARRAY_MEMCMP) && defined(BOOST_GCC)
+# define BOOST_ARRAY_MEMCMP __builtin_memcmp
+#endif
+
+#if !defined(BOOST_ARRAY_MEMCMP)
+# define BOOST_ARRAY_MEMCMP std::memcmp
+#endif
+
+// BOOST_ARRAY_ASSUME(cond) states cond as an optimizer invariant. In
+// release builds the assertion in operator[] compiles away to nothing;
+// restating i < N here lets the optimizer drop redundant bounds checks
+// and sign extensions in inlined callers.
+
+#if defined(BOOST_CLANG)
+# define BOOST_ARRAY_ASSUME(cond) __builtin_assume(cond)
+#elif defined(BOOST_GCC)
+# define BOOST_ARRAY_ASSUME(cond) ((cond)? (void)0: __builtin_unreachable())
+#elif defined(BOOST_MSVC)
+# define BOOST_ARRAY_ASSUME(cond) __assume(cond)
+#else
+# define BOOST_ARRAY_ASSUME(cond) ((void)0)
+#endif
+
+// When BOOST_ARRAY_ENABLE_ALIGNMENT is defined, the array storage is
+// over-aligned to a power of two of up to 64 bytes (one cache line),
+// which enables aligned vector loads over the elements and keeps
+// adjacent arrays on separate cache lines. This changes the layout
+// of boost::array, and is therefore opt-in.
+
+#if defined(BOOST_ARRAY_ENABLE_ALIGNMENT) && !defined(BOOST_NO_CXX11_ALIGNAS)
+# define BOOST_ARRAY_ALIGNAS(T, N) alignas(boost::detail::array_alignment<T, N>::value)
+# include <memory> // for std::assume_aligned
+#else
+# define BOOST_ARRAY_ALIGNAS(T, N)
+#endif
+
+// BOOST_ARRAY_ASSUME_ALIGNED(p, T, N) communicates the opt-in storage
+// alignment to the callers of data(), letting their vectorized loops
+// skip the runtime alignment checks and peel loops that unaligned
+// pointers require. std::assume_aligned is usable in constant
+// expressions, so data() stays constexpr.
+
+#if defined(BOOST_ARRAY_ALIGNAS) && defined(__cpp_lib_assume_aligned) && __cpp_lib_assume_aligned >= 201811L && defined(BOOST_ARRAY_ENABLE_ALIGNMENT)
+# define BOOST_ARRAY_ASSUME_ALIGNED(p, T, N) std::assume_aligned<boost::detail::array_alignment<T, N>::value>( p )
+#else
+# define BOOST_ARRAY_ASSUME_ALIGNED(p, T, N) ( p )
+#endif
 
 #if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
 # if __has_include(<compare>)
@@ -57,12 +190,162 @@
 # endif
 #endif
 
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+# include <span>
+#endif
+
+#if !defined(BOOST_NO_CXX11_HDR_TUPLE)
+# include <tuple>
+#endif
+
 namespace boost {
 
+    namespace detail {
+
+    // out-of-range throw helper; deliberately not inlined, so that the
+    // exception object construction and the throw stay out of the callers
+    // and off the hot path of at()
+
+    BOOST_NORETURN BOOST_NOINLINE inline void array_throw_out_of_range( const char* msg )
+    {
+        boost::throw_exception( std::out_of_range( msg ) );
+    }
+
+    } // namespace detail
+
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+    namespace detail {
+
+    // fill() helper; the true_type overload turns fills into memset when
+    // the object representation of the value is a single repeated byte,
+    // which covers byte-sized T as well as common values such as 0 and -1
+    // of the wider integer (and floating point) types
+
+    template<class T>
+    inline void array_fill( T* p, std::size_t n, const T& v, std::false_type )
+    {
+        // using p[ 0 ] as a temporary copy
+        // avoids the aliasing opportunity betw.
+        // `v` and the destination
+
+        p[ 0 ] = v;
+
+        BOOST_ARRAY_UNROLL
+        for( std::size_t i = 1; i < n; ++i )
+        {
+            p[ i ] = p[ 0 ];
+        }
+    }
+
+    template<class T>
+    inline void array_fill( T* p, std::size_t n, const T& v, std::true_type )
+    {
+        unsigned char buf[ sizeof(T) ];
+
+        std::memcpy( buf, &v, sizeof(T) );
+
+        bool uniform = true;
+
+        for( std::size_t i = 1; i < sizeof(T); ++i )
+        {
+            uniform = uniform && ( buf[ i ] == buf[ 0 ] );
+        }
+
+        if( uniform )
+        {
+            std::memset( p, buf[ 0 ], n * sizeof(T) );
+            return;
+        }
+
+        array_fill( p, n, v, std::false_type() );
+    }
+
+    // true when equality of T values is equivalent to equality of their
+    // object representations, making memcmp a valid implementation of
+    // operator==. Limited to the types whose comparison is necessarily
+    // the builtin one (it cannot be overloaded) and whose representations
+    // are unique: notably false for floating point types (-0.0 == 0.0),
+    // for enumerations (operator== over them can be user-defined), and
+    // for class types, whose user-defined operator== need not be bitwise
+    // even when the representation is padding-free
+
+    template<class T> struct array_is_bitwise_comparable:
+        std::integral_constant<bool,
+            std::is_integral<T>::value || std::is_pointer<T>::value> {};
+
+    // swap() helper for trivially copyable types; exchanges the storage
+    // through a temporary buffer with three memcpy calls per block, which
+    // the optimizer lowers to wide vector loads and stores instead of a
+    // scalar exchange per element
+
+    template<class T, std::size_t N>
+    inline void array_swap( T (&x)[N], T (&y)[N] )
+    {
+        unsigned char* p = reinterpret_cast<unsigned char*>( x );
+        unsigned char* q = reinterpret_cast<unsigned char*>( y );
+
+        if( p == q ) return;
+
+        // blocks are capped at 256 bytes to bound the stack buffer
+
+        unsigned char tmp[ sizeof(x) < 256? sizeof(x): 256 ];
+
+        std::size_t m = sizeof(x);
+
+        while( m >= sizeof(tmp) )
+        {
+            BOOST_ARRAY_PREFETCH( p + sizeof(tmp) );
+            BOOST_ARRAY_PREFETCH( q + sizeof(tmp) );
+
+            std::memcpy( tmp, p, sizeof(tmp) );
+            std::memcpy( p, q, sizeof(tmp) );
+            std::memcpy( q, tmp, sizeof(tmp) );
+
+            p += sizeof(tmp);
+            q += sizeof(tmp);
+            m -= sizeof(tmp);
+        }
+
+        if( m > 0 )
+        {
+            std::memcpy( tmp, p, m );
+            std::memcpy( p, q, m );
+            std::memcpy( q, tmp, m );
+        }
+    }
+
+    } // namespace detail
+
+#endif
+
+#if defined(BOOST_ARRAY_ENABLE_ALIGNMENT) && !defined(BOOST_NO_CXX11_ALIGNAS)
+
+    namespace detail {
+
+    // alignment, in bytes, of the over-aligned array storage: the largest
+    // power of two not exceeding the storage size, capped at 64, and
+    // never less than the natural alignment of T
+
+    template<class T, std::size_t N> struct array_alignment
+    {
+        static const std::size_t size = sizeof(T) * N;
+
+        static const std::size_t cap =
+            size >= 64? 64: size >= 32? 32: size >= 16? 16:
+            size >= 8? 8: size >= 4? 4: size >= 2? 2: 1;
+
+        static const std::size_t value = cap > alignof(T)? cap: alignof(T);
+    };
+
+    } // namespace detail
+
+#endif
+
     template<class T, std::size_t N>
     class array {
       public:
-        T elems[N];    // fixed-size array of elements of type T
+        BOOST_ARRAY_ALIGNAS(T, N) T elems[N];    // fixed-size array of elements of type T
 
       public:
         // type definitions
@@ -75,100 +358,152 @@ namespace boost {
         typedef std::ptrdiff_t difference_type;
 
         // iterator support
-        BOOST_CXX14_CONSTEXPR iterator  begin()       BOOST_NOEXCEPT { return elems; }
-        BOOST_CONSTEXPR const_iterator  begin() const BOOST_NOEXCEPT { return elems; }
-        BOOST_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT { return elems; }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR iterator  begin()       BOOST_NOEXCEPT { return elems; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator  begin() const BOOST_NOEXCEPT { return elems; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT { return elems; }
 
-        BOOST_CXX14_CONSTEXPR iterator  end()       BOOST_NOEXCEPT { return elems+N; }
-        BOOST_CONSTEXPR const_iterator  end() const BOOST_NOEXCEPT { return elems+N; }
-        BOOST_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT { return elems+N; }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR iterator  end()       BOOST_NOEXCEPT { return elems+N; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator  end() const BOOST_NOEXCEPT { return elems+N; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT { return elems+N; }
 
         // reverse iterator support
         typedef std::reverse_iterator<iterator> reverse_iterator;
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
-        reverse_iterator rbegin() BOOST_NOEXCEPT { return reverse_iterator(end()); }
-        const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 reverse_iterator rbegin() BOOST_NOEXCEPT { return reverse_iterator(end()); }
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
             return const_reverse_iterator(end());
         }
-        const_reverse_iterator crbegin() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator crbegin() const BOOST_NOEXCEPT {
             return const_reverse_iterator(end());
         }
 
-        reverse_iterator rend() BOOST_NOEXCEPT { return reverse_iterator(begin()); }
-        const_reverse_iterator rend() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 reverse_iterator rend() BOOST_NOEXCEPT { return reverse_iterator(begin()); }
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator rend() const BOOST_NOEXCEPT {
             return const_reverse_iterator(begin());
         }
-        const_reverse_iterator crend() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator crend() const BOOST_NOEXCEPT {
             return const_reverse_iterator(begin());
         }
 
         // operator[]
-        BOOST_CXX14_CONSTEXPR reference operator[](size_type i)
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR reference operator[](size_type i)
         {
-            return BOOST_ASSERT_MSG( i < N, "out of range" ), elems[i];
+            return BOOST_ASSERT_MSG( i < N, "out of range" ), BOOST_ARRAY_ASSUME( i < N ), elems[i];
         }
 
 #if !BOOST_WORKAROUND(BOOST_GCC, < 50000)
         BOOST_CONSTEXPR
 #endif
-        const_reference operator[](size_type i) const
+        BOOST_FORCEINLINE const_reference operator[](size_type i) const
         {
-            return BOOST_ASSERT_MSG( i < N, "out of range" ), elems[i];
+            return BOOST_ASSERT_MSG( i < N, "out of range" ), BOOST_ARRAY_ASSUME( i < N ), elems[i];
         }
 
         // at() with range check
-        BOOST_CXX14_CONSTEXPR reference at(size_type i)       { return rangecheck(i), elems[i]; }
+        BOOST_CXX14_CONSTEXPR reference at(size_type i)
+        {
+            if( BOOST_UNLIKELY( i >= N ) )
+            {
+                detail::array_throw_out_of_range( "array<>: index out of range" );
+            }
+
+            return elems[ i ];
+        }
+
+        // the conditional-expression form keeps the const overload usable
+        // in C++11 constant expressions
         BOOST_CONSTEXPR const_reference at(size_type i) const { return rangecheck(i), elems[i]; }
 
         // front() and back()
-        BOOST_CXX14_CONSTEXPR reference front()
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR reference front() BOOST_NOEXCEPT
         {
             return elems[0];
         }
 
-        BOOST_CONSTEXPR const_reference front() const
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_reference front() const BOOST_NOEXCEPT
         {
             return elems[0];
         }
 
-        BOOST_CXX14_CONSTEXPR reference back()
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR reference back() BOOST_NOEXCEPT
         {
             return elems[N-1];
         }
 
-        BOOST_CONSTEXPR const_reference back() const
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_reference back() const BOOST_NOEXCEPT
         {
             return elems[N-1];
         }
 
         // size is constant
-        static BOOST_CONSTEXPR size_type size() BOOST_NOEXCEPT { return N; }
-        static BOOST_CONSTEXPR bool empty() BOOST_NOEXCEPT { return false; }
-        static BOOST_CONSTEXPR size_type max_size() BOOST_NOEXCEPT { return N; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR size_type size() BOOST_NOEXCEPT { return N; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR bool empty() BOOST_NOEXCEPT { return false; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR size_type max_size() BOOST_NOEXCEPT { return N; }
+
+// implicitly inline, so no out-of-class definition is needed
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+        static constexpr size_type static_size = N;
+#else
         enum { static_size = N };
+#endif
 
         // swap (note: linear complexity)
         BOOST_CXX14_CONSTEXPR void swap (array<T,N>& y)
         {
-            std::swap( elems, y.elems );
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+            if( std::is_trivially_copyable<T>::value && !BOOST_ARRAY_IS_CONSTANT_EVALUATED() )
+            {
+                detail::array_swap( elems, y.elems );
+                return;
+            }
+
+#endif
+            std::swap_ranges( elems, elems + N, y.elems );
         }
 
         // direct access to data
-        BOOST_CONSTEXPR const T* data() const BOOST_NOEXCEPT { return elems; }
-        BOOST_CXX14_CONSTEXPR T* data() BOOST_NOEXCEPT { return elems; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const T* data() const BOOST_NOEXCEPT { return BOOST_ARRAY_ASSUME_ALIGNED( elems, T, N ); }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR T* data() BOOST_NOEXCEPT { return BOOST_ARRAY_ASSUME_ALIGNED( elems, T, N ); }
 
         // obsolete
         BOOST_DEPRECATED( "please use `data()` instead" )
         T* c_array() BOOST_NOEXCEPT { return elems; }
 
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+
+        // byte views over the storage; std::byte may alias any type, so
+        // user-written bulk kernels can inspect the representation without
+        // casting data() themselves
+
+        std::span<std::byte, N * sizeof(T)> as_bytes() BOOST_NOEXCEPT
+        {
+            return std::span<std::byte, N * sizeof(T)>( reinterpret_cast<std::byte*>( data() ), N * sizeof(T) );
+        }
+
+        std::span<const std::byte, N * sizeof(T)> as_bytes() const BOOST_NOEXCEPT
+        {
+            return std::span<const std::byte, N * sizeof(T)>( reinterpret_cast<const std::byte*>( data() ), N * sizeof(T) );
+        }
+
+#endif
+
         // assignment with type conversion
         template <typename T2>
         array<T,N>& operator= (const array<T2,N>& rhs)
         {
+            // T2 != T, so the operands are distinct objects and cannot
+            // overlap; the restrict qualifiers make that visible to the
+            // vectorizer
+
+            T* BOOST_RESTRICT dst = elems;
+            const T2* BOOST_RESTRICT src = rhs.elems;
+
+            BOOST_ARRAY_UNROLL
             for( std::size_t i = 0; i < N; ++i )
             {
-                elems[ i ] = rhs.elems[ i ];
+                dst[ i ] = src[ i ];
             }
 
             return *this;
@@ -177,6 +512,17 @@ namespace boost {
         // fill with one value
         BOOST_CXX14_CONSTEXPR void fill (const T& value)
         {
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+            if( !BOOST_ARRAY_IS_CONSTANT_EVALUATED() )
+            {
+                detail::array_fill( elems, N, value,
+                    std::integral_constant<bool,
+                        sizeof(T) <= 8 && std::is_trivially_copyable<T>::value>() );
+                return;
+            }
+
+#endif
             // using elems[ 0 ] as a temporary copy
             // avoids the aliasing opportunity betw.
             // `value` and `elems`
@@ -195,7 +541,7 @@ namespace boost {
 
         // check range (may be private because it is static)
         static BOOST_CONSTEXPR bool rangecheck (size_type i) {
-            return i >= size() ? boost::throw_exception(std::out_of_range ("array<>: index out of range")), true : true;
+            return BOOST_UNLIKELY( i >= size() ) ? detail::array_throw_out_of_range( "array<>: index out of range" ), true : true;
         }
 
     };
@@ -216,31 +562,31 @@ namespace boost {
         typedef std::ptrdiff_t difference_type;
 
         // iterator support
-        BOOST_CXX14_CONSTEXPR iterator  begin()       BOOST_NOEXCEPT { return data(); }
-        BOOST_CONSTEXPR const_iterator  begin() const BOOST_NOEXCEPT { return data(); }
-        BOOST_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT { return data(); }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR iterator  begin()       BOOST_NOEXCEPT { return data(); }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator  begin() const BOOST_NOEXCEPT { return data(); }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator cbegin() const BOOST_NOEXCEPT { return data(); }
 
-        BOOST_CXX14_CONSTEXPR iterator  end()       BOOST_NOEXCEPT { return  begin(); }
-        BOOST_CONSTEXPR const_iterator  end() const BOOST_NOEXCEPT { return  begin(); }
-        BOOST_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT { return cbegin(); }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR iterator  end()       BOOST_NOEXCEPT { return  begin(); }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator  end() const BOOST_NOEXCEPT { return  begin(); }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const_iterator cend() const BOOST_NOEXCEPT { return cbegin(); }
 
         // reverse iterator support
         typedef std::reverse_iterator<iterator> reverse_iterator;
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
-        reverse_iterator rbegin() BOOST_NOEXCEPT { return reverse_iterator(end()); }
-        const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 reverse_iterator rbegin() BOOST_NOEXCEPT { return reverse_iterator(end()); }
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator rbegin() const BOOST_NOEXCEPT {
             return const_reverse_iterator(end());
         }
-        const_reverse_iterator crbegin() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator crbegin() const BOOST_NOEXCEPT {
             return const_reverse_iterator(end());
         }
 
-        reverse_iterator rend() BOOST_NOEXCEPT { return reverse_iterator(begin()); }
-        const_reverse_iterator rend() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 reverse_iterator rend() BOOST_NOEXCEPT { return reverse_iterator(begin()); }
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator rend() const BOOST_NOEXCEPT {
             return const_reverse_iterator(begin());
         }
-        const_reverse_iterator crend() const BOOST_NOEXCEPT {
+        BOOST_ARRAY_CONSTEXPR17 const_reverse_iterator crend() const BOOST_NOEXCEPT {
             return const_reverse_iterator(begin());
         }
 
@@ -281,23 +627,45 @@ namespace boost {
         }
 
         // size is constant
-        static BOOST_CONSTEXPR size_type size() BOOST_NOEXCEPT { return 0; }
-        static BOOST_CONSTEXPR bool empty() BOOST_NOEXCEPT { return true; }
-        static BOOST_CONSTEXPR size_type max_size() BOOST_NOEXCEPT { return 0; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR size_type size() BOOST_NOEXCEPT { return 0; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR bool empty() BOOST_NOEXCEPT { return true; }
+        BOOST_FORCEINLINE static BOOST_CONSTEXPR size_type max_size() BOOST_NOEXCEPT { return 0; }
+
+// implicitly inline, so no out-of-class definition is needed
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+        static constexpr size_type static_size = 0;
+#else
         enum { static_size = 0 };
+#endif
 
         BOOST_CXX14_CONSTEXPR void swap (array<T,0>& /*y*/)
         {
         }
 
         // direct access to data
-        BOOST_CONSTEXPR const T* data() const BOOST_NOEXCEPT { return 0; }
-        BOOST_CXX14_CONSTEXPR T* data() BOOST_NOEXCEPT { return 0; }
+        BOOST_FORCEINLINE BOOST_CONSTEXPR const T* data() const BOOST_NOEXCEPT { return 0; }
+        BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR T* data() BOOST_NOEXCEPT { return 0; }
 
         // obsolete
         BOOST_DEPRECATED( "please use `data()` instead" )
         T* c_array() BOOST_NOEXCEPT { return 0; }
 
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+
+        // byte views over the storage
+
+        std::span<std::byte, 0> as_bytes() BOOST_NOEXCEPT
+        {
+            return std::span<std::byte, 0>();
+        }
+
+        std::span<const std::byte, 0> as_bytes() const BOOST_NOEXCEPT
+        {
+            return std::span<const std::byte, 0>();
+        }
+
+#endif
+
         // assignment with type conversion
         template <typename T2>
         array<T,0>& operator= (const array<T2,0>& ) {
@@ -314,14 +682,24 @@ namespace boost {
         // check range (may be private because it is static)
         static reference failed_rangecheck ()
         {
-            boost::throw_exception( std::out_of_range( "attempt to access element of an empty array" ) );
+            detail::array_throw_out_of_range( "attempt to access element of an empty array" );
         }
     };
 
     // comparisons
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator== (const array<T,N>& x, const array<T,N>& y)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator== (const array<T,N>& x, const array<T,N>& y)
     {
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+        if( N != 0 && detail::array_is_bitwise_comparable<T>::value &&
+            !BOOST_ARRAY_IS_CONSTANT_EVALUATED() )
+        {
+            return BOOST_ARRAY_MEMCMP( x.data(), y.data(), N * sizeof(T) ) == 0;
+        }
+
+#endif
+        BOOST_ARRAY_UNROLL
         for( std::size_t i = 0; i < N; ++i )
         {
             if( !( x[ i ] == y[ i ] ) ) return false;
@@ -333,7 +711,7 @@ namespace boost {
 #if BOOST_WORKAROUND(BOOST_GCC, < 90000)
 
     template<class T>
-    BOOST_CXX14_CONSTEXPR bool operator== (const array<T, 0>& /*x*/, const array<T, 0>& /*y*/)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator== (const array<T, 0>& /*x*/, const array<T, 0>& /*y*/)
     {
         return true;
     }
@@ -341,13 +719,27 @@ namespace boost {
 #endif
 
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator!= (const array<T,N>& x, const array<T,N>& y) {
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator!= (const array<T,N>& x, const array<T,N>& y) {
         return !(x==y);
     }
 
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator< (const array<T,N>& x, const array<T,N>& y)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator< (const array<T,N>& x, const array<T,N>& y)
     {
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+        // for unsigned byte-sized types, and only for those, memcmp order
+        // coincides with lexicographic element order
+
+        if( N != 0 && sizeof(T) == 1 &&
+            std::is_integral<T>::value && std::is_unsigned<T>::value &&
+            !BOOST_ARRAY_IS_CONSTANT_EVALUATED() )
+        {
+            return BOOST_ARRAY_MEMCMP( x.data(), y.data(), N ) < 0;
+        }
+
+#endif
+        BOOST_ARRAY_UNROLL
         for( std::size_t i = 0; i < N; ++i )
         {
             if( x[ i ] < y[ i ] ) return true;
@@ -360,7 +752,7 @@ namespace boost {
 #if BOOST_WORKAROUND(BOOST_GCC, < 90000)
 
     template<class T>
-    BOOST_CXX14_CONSTEXPR bool operator< (const array<T, 0>& /*x*/, const array<T, 0>& /*y*/)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator< (const array<T, 0>& /*x*/, const array<T, 0>& /*y*/)
     {
         return false;
     }
@@ -368,33 +760,103 @@ namespace boost {
 #endif
 
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator> (const array<T,N>& x, const array<T,N>& y) {
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator> (const array<T,N>& x, const array<T,N>& y) {
         return y<x;
     }
 
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator<= (const array<T,N>& x, const array<T,N>& y) {
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator<= (const array<T,N>& x, const array<T,N>& y) {
         return !(y<x);
     }
 
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR bool operator>= (const array<T,N>& x, const array<T,N>& y) {
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR bool operator>= (const array<T,N>& x, const array<T,N>& y) {
         return !(x<y);
     }
 
     // global swap()
     template<class T, std::size_t N>
-    BOOST_CXX14_CONSTEXPR inline void swap (array<T,N>& x, array<T,N>& y) {
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void swap (array<T,N>& x, array<T,N>& y) {
         x.swap(y);
     }
 
+    // batched operations over ranges of arrays; filling or swapping many
+    // small arrays one call at a time pays the call overhead per array,
+    // a single batched call amortizes it over the whole range
+
+    template<class It, class T2>
+    inline void array_fill_batch (It first, It last, const T2& value)
+    {
+        for( ; first != last; ++first )
+        {
+            first->fill( value );
+        }
+    }
+
+#if defined(BOOST_ARRAY_HAS_TYPE_TRAITS)
+
+    // a contiguous range of arrays is a contiguous range of elements
+    // (unless opt-in over-alignment introduced tail padding), so it can
+    // be filled in one pass, allowing a single memset over the range
+
+    template<class T, std::size_t N, class T2>
+    inline void array_fill_batch (array<T, N>* first, array<T, N>* last, const T2& value)
+    {
+        if( first == last ) return;
+
+        // the fused pass treats the range as one contiguous T sequence,
+        // which is only valid for trivially copyable elements in arrays
+        // without padding
+
+        if( N != 0 && std::is_trivially_copyable<T>::value &&
+            sizeof( array<T, N> ) == sizeof(T) * N )
+        {
+            T const v = value;
+
+            detail::array_fill( first->data(), static_cast<std::size_t>( last - first ) * N, v,
+                std::integral_constant<bool,
+                    sizeof(T) <= 8 && std::is_trivially_copyable<T>::value>() );
+        }
+        else
+        {
+            for( ; first != last; ++first )
+            {
+                first->fill( value );
+            }
+        }
+    }
+
+#endif
+
+    template<class It1, class It2>
+    inline void array_swap_batch (It1 first1, It1 last1, It2 first2)
+    {
+        for( ; first1 != last1; ++first1, ++first2 )
+        {
+            first1->swap( *first2 );
+        }
+    }
+
 #if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
 # if __has_include(<compare>)
 
     template<class T, std::size_t N>
-    constexpr auto operator<=> (const array<T,N>& x, const array<T,N>& y)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE constexpr auto operator<=> (const array<T,N>& x, const array<T,N>& y)
         -> decltype( x.elems[ 0 ] <=> y.elems[ 0 ] )
     {
+        // for unsigned byte-sized types memcmp order coincides with
+        // element order, and its sign is the ordering; one pass instead
+        // of a scan per relational operator
+
+        if constexpr( sizeof(T) == 1 && std::is_integral_v<T> && std::is_unsigned_v<T> )
+        {
+            if( !std::is_constant_evaluated() )
+            {
+                return BOOST_ARRAY_MEMCMP( x.data(), y.data(), N ) <=> 0;
+            }
+        }
+
+        BOOST_ARRAY_UNROLL
         for( std::size_t i = 0; i < N; ++i )
         {
             auto r = x.elems[ i ] <=> y.elems[ i ];
@@ -405,7 +867,7 @@ namespace boost {
     }
 
     template<class T>
-    constexpr auto operator<=> (const array<T,0>& /*x*/, const array<T,0>& /*y*/)
+    BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE constexpr auto operator<=> (const array<T,0>& /*x*/, const array<T,0>& /*y*/)
         -> std::strong_ordering
     {
         return std::strong_ordering::equal;
@@ -431,17 +893,27 @@ namespace boost {
     }
 
    template <size_t Idx, typename T, size_t N>
-   BOOST_CXX14_CONSTEXPR T &get(boost::array<T,N> &arr) BOOST_NOEXCEPT {
+   BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR T &get(boost::array<T,N> &arr) BOOST_NOEXCEPT {
        BOOST_STATIC_ASSERT_MSG ( Idx < N, "boost::get<>(boost::array &) index out of range" );
        return arr[Idx];
        }
 
    template <size_t Idx, typename T, size_t N>
-   BOOST_CONSTEXPR const T &get(const boost::array<T,N> &arr) BOOST_NOEXCEPT {
+   BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CONSTEXPR const T &get(const boost::array<T,N> &arr) BOOST_NOEXCEPT {
        BOOST_STATIC_ASSERT_MSG ( Idx < N, "boost::get<>(const boost::array &) index out of range" );
        return arr[Idx];
        }
 
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+   template <size_t Idx, typename T, size_t N>
+   BOOST_ARRAY_NODISCARD BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR T &&get(boost::array<T,N> &&arr) BOOST_NOEXCEPT {
+       BOOST_STATIC_ASSERT_MSG ( Idx < N, "boost::get<>(boost::array &&) index out of range" );
+       return std::move( arr[Idx] );
+       }
+
+#endif
+
 } /* namespace boost */
 
 #ifndef BOOST_NO_CXX11_HDR_ARRAY
@@ -463,6 +935,24 @@ namespace std {
 }
 #endif
 
+#if !defined(BOOST_NO_CXX11_HDR_TUPLE)
+
+// opt into the tuple-like protocol; together with boost::get, this
+// enables structured bindings over boost::array
+
+namespace std {
+
+   template <typename T, size_t N>
+   struct tuple_size< boost::array<T, N> >: integral_constant<size_t, N> {};
+
+   template <size_t Idx, typename T, size_t N>
+   struct tuple_element< Idx, boost::array<T, N> > {
+       typedef T type;
+   };
+
+}
+#endif
+
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
 # pragma warning(pop)
 #endif
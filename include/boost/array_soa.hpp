@@ -0,0 +1,145 @@
+#ifndef BOOST_ARRAY_SOA_HPP_INCLUDED
+#define BOOST_ARRAY_SOA_HPP_INCLUDED
+
+/* A structure-of-arrays companion to boost::array.
+ *
+ * Where array<S, N> with a multi-field S interleaves the fields of each
+ * element in memory (array-of-structures), soa_array<N, Ts...> stores
+ * one contiguous array<Ti, N> per field. Loops that touch a single
+ * field then traverse contiguous memory at full cache line utilization
+ * and remain vectorizable, instead of striding over the unused fields.
+ *
+ * See
+ *      http://www.boost.org/libs/array/
+ * for documentation.
+ *
+ * (C) Copyright Peter Dimov 2026.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/array.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_NO_CXX11_HDR_TUPLE)
+
+# error <boost/array_soa.hpp> requires C++11 (variadic templates, <tuple>)
+
+#else
+
+#include <tuple>
+#include <cstddef>
+
+namespace boost {
+
+    template<std::size_t N, class... Ts>
+    class soa_array {
+      public:
+        typedef std::tuple< boost::array<Ts, N>... > columns_type;
+
+        template<std::size_t I> struct column
+        {
+            typedef typename std::tuple_element<I, columns_type>::type type;
+        };
+
+        columns_type columns;    // one fixed-size array per field
+
+      public:
+        // column access
+
+        template<std::size_t I>
+        BOOST_CXX14_CONSTEXPR typename column<I>::type& col() BOOST_NOEXCEPT
+        {
+            return std::get<I>( columns );
+        }
+
+        template<std::size_t I>
+        BOOST_CONSTEXPR const typename column<I>::type& col() const BOOST_NOEXCEPT
+        {
+            return std::get<I>( columns );
+        }
+
+        // per-element access; a row is a tuple of references, one into
+        // each column, so AoS-style element code keeps working on the
+        // SoA layout
+
+        typedef std::tuple<Ts&...> reference;
+        typedef std::tuple<const Ts&...> const_reference;
+
+        BOOST_CXX14_CONSTEXPR reference operator[] (std::size_t i)
+        {
+            return BOOST_ASSERT_MSG( i < N, "out of range" ), row_impl( i, make_index_sequence() );
+        }
+
+        BOOST_CONSTEXPR const_reference operator[] (std::size_t i) const
+        {
+            return BOOST_ASSERT_MSG( i < N, "out of range" ), row_impl( i, make_index_sequence() );
+        }
+
+        // size is constant
+
+        static BOOST_CONSTEXPR std::size_t size() BOOST_NOEXCEPT { return N; }
+        static BOOST_CONSTEXPR bool empty() BOOST_NOEXCEPT { return N == 0; }
+        static BOOST_CONSTEXPR std::size_t columns_size() BOOST_NOEXCEPT { return sizeof...(Ts); }
+
+        // fill every column with one value per field
+
+        BOOST_CXX14_CONSTEXPR void fill (const Ts&... values)
+        {
+            fill_impl( values..., make_index_sequence() );
+        }
+
+        BOOST_CXX14_CONSTEXPR void swap (soa_array<N, Ts...>& y)
+        {
+            columns.swap( y.columns );
+        }
+
+      private:
+        // std::index_sequence is C++14; a minimal local substitute
+
+        template<std::size_t... I> struct index_sequence {};
+
+        template<std::size_t K, std::size_t... I> struct make_index_sequence_: make_index_sequence_<K - 1, K - 1, I...> {};
+        template<std::size_t... I> struct make_index_sequence_<0, I...> { typedef index_sequence<I...> type; };
+
+        static BOOST_CONSTEXPR typename make_index_sequence_<sizeof...(Ts)>::type make_index_sequence()
+        {
+            return typename make_index_sequence_<sizeof...(Ts)>::type();
+        }
+
+        template<std::size_t... I>
+        BOOST_CXX14_CONSTEXPR reference row_impl (std::size_t i, index_sequence<I...>)
+        {
+            return reference( std::get<I>( columns )[ i ]... );
+        }
+
+        template<std::size_t... I>
+        BOOST_CONSTEXPR const_reference row_impl (std::size_t i, index_sequence<I...>) const
+        {
+            return const_reference( std::get<I>( columns )[ i ]... );
+        }
+
+        template<std::size_t... I>
+        BOOST_CXX14_CONSTEXPR void fill_impl (const Ts&... values, index_sequence<I...>)
+        {
+            int unused[] = { ( std::get<I>( columns ).fill( values ), 0 )... };
+            (void)unused;
+        }
+    };
+
+    // global swap()
+
+    template<std::size_t N, class... Ts>
+    inline void swap (soa_array<N, Ts...>& x, soa_array<N, Ts...>& y)
+    {
+        x.swap( y );
+    }
+
+} /* namespace boost */
+
+#endif
+
+#endif // #ifndef BOOST_ARRAY_SOA_HPP_INCLUDED
@@ -0,0 +1,53 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_ARRAY_ENABLE_ALIGNMENT
+
+#include <boost/array.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX11_ALIGNAS)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because BOOST_NO_CXX11_ALIGNAS is defined")
+int main() {}
+
+#else
+
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+int main()
+{
+    // the storage alignment is the largest power of two not exceeding
+    // the storage size, capped at 64 and never below alignof(T)
+
+    BOOST_TEST_EQ( alignof( boost::array<char, 3> ), 2u );
+    BOOST_TEST_EQ( alignof( boost::array<char, 8> ), 8u );
+    BOOST_TEST_EQ( alignof( boost::array<char, 100> ), 64u );
+
+    BOOST_TEST_EQ( alignof( boost::array<int, 4> ), 16u );
+    BOOST_TEST_EQ( alignof( boost::array<int, 16> ), 64u );
+
+    BOOST_TEST_EQ( alignof( boost::array<double, 8> ), 64u );
+    BOOST_TEST_EQ( alignof( boost::array<double, 1024> ), 64u );
+
+    // alignof(T) is respected even when the storage is smaller
+
+    BOOST_TEST_EQ( alignof( boost::array<double, 1> ), alignof( double ) );
+
+    // the array remains usable as usual
+
+    boost::array<int, 16> a = {};
+
+    a.fill( 5 );
+
+    BOOST_TEST_EQ( a[0], 5 );
+    BOOST_TEST_EQ( a[15], 5 );
+    BOOST_TEST_EQ( reinterpret_cast<std::size_t>( a.data() ) % 64u, 0u );
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <string>
+
+template<class T> void test()
+{
+    boost::array<T, 5> a[ 7 ];
+
+    boost::array_fill_batch( a, a + 7, 3 );
+
+    for( std::size_t i = 0; i < 7; ++i )
+    {
+        for( std::size_t j = 0; j < 5; ++j )
+        {
+            BOOST_TEST_EQ( a[i][j], 3 );
+        }
+    }
+
+    boost::array<T, 5> b[ 7 ];
+
+    boost::array_fill_batch( b, b + 7, 4 );
+    boost::array_swap_batch( a, a + 7, b );
+
+    for( std::size_t i = 0; i < 7; ++i )
+    {
+        for( std::size_t j = 0; j < 5; ++j )
+        {
+            BOOST_TEST_EQ( a[i][j], 4 );
+            BOOST_TEST_EQ( b[i][j], 3 );
+        }
+    }
+}
+
+void test2()
+{
+    // non-trivial element type takes the per-array path
+
+    boost::array<std::string, 2> a[ 3 ];
+
+    boost::array_fill_batch( a, a + 3, "x" );
+
+    for( std::size_t i = 0; i < 3; ++i )
+    {
+        BOOST_TEST_EQ( a[i][0], "x" );
+        BOOST_TEST_EQ( a[i][1], "x" );
+    }
+}
+
+void test3()
+{
+    // empty range
+
+    boost::array<int, 4>* p = 0;
+
+    boost::array_fill_batch( p, p, 1 );
+    boost::array_swap_batch( p, p, p );
+}
+
+int main()
+{
+    test<int>();
+    test<unsigned char>();
+    test<double>();
+
+    test2();
+    test3();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/array.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(__cpp_lib_span) || __cpp_lib_span < 202002L
+
+BOOST_PRAGMA_MESSAGE("Test skipped because __cpp_lib_span is not defined")
+int main() {}
+
+#else
+
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstring>
+
+template<class T, std::size_t N> void test()
+{
+    boost::array<T, N> a = {};
+
+    std::span<std::byte, N * sizeof(T)> s = a.as_bytes();
+
+    BOOST_TEST_EQ( s.size(), N * sizeof(T) );
+    BOOST_TEST_EQ( static_cast<void*>( s.data() ), static_cast<void*>( a.data() ) );
+
+    // writes through the view are visible through the elements
+
+    std::memset( s.data(), 0xFF, s.size() );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( a[ i ], static_cast<T>( -1 ) );
+    }
+
+    boost::array<T, N> const& ca = a;
+
+    std::span<const std::byte, N * sizeof(T)> cs = ca.as_bytes();
+
+    BOOST_TEST_EQ( cs.size(), N * sizeof(T) );
+    BOOST_TEST_EQ( static_cast<const void*>( cs.data() ), static_cast<const void*>( ca.data() ) );
+}
+
+template<class T> void test2()
+{
+    boost::array<T, 0> a = {{}};
+
+    std::span<std::byte, 0> s = a.as_bytes();
+
+    BOOST_TEST_EQ( s.size(), 0u );
+}
+
+int main()
+{
+    test<unsigned char, 7>();
+    test<int, 4>();
+    test<long long, 3>();
+
+    test2<int>();
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,59 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+// Same-type assignment goes through the implicitly-defined copy
+// assignment operator, which is trivial (and hence memcpy-equivalent)
+// when T is trivially copyable; pin that down so that the converting
+// operator= doesn't accidentally start handling the same-type case.
+
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <boost/config/workaround.hpp>
+#include <cstddef>
+#include <string>
+
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && !BOOST_WORKAROUND(BOOST_LIBSTDCXX_VERSION, < 50000)
+# include <boost/core/lightweight_test_trait.hpp>
+# include <type_traits>
+# define HAVE_TYPE_TRAITS
+#endif
+
+template<class T> void test()
+{
+    boost::array<T, 4> a1 = {{ 1, 2, 3, 4 }};
+    boost::array<T, 4> a2 = {};
+
+    a2 = a1;
+
+    for( std::size_t i = 0; i < 4; ++i )
+    {
+        BOOST_TEST_EQ( a1[i], a2[i] );
+    }
+}
+
+int main()
+{
+    test<int>();
+    test<double>();
+
+    {
+        boost::array<std::string, 2> a1 = {{ "x", "y" }};
+        boost::array<std::string, 2> a2;
+
+        a2 = a1;
+
+        BOOST_TEST_EQ( a2[0], "x" );
+        BOOST_TEST_EQ( a2[1], "y" );
+    }
+
+#if defined(HAVE_TYPE_TRAITS)
+
+    BOOST_TEST_TRAIT_TRUE(( std::is_trivially_copy_assignable< boost::array<int, 4> > ));
+    BOOST_TEST_TRAIT_TRUE(( std::is_trivially_copyable< boost::array<int, 4> > ));
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+// runtime coverage for the memcmp fast path in operator== and for the
+// element loop fallback
+
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+template<class T, std::size_t N> void test()
+{
+    boost::array<T, N> a1 = {};
+    boost::array<T, N> a2 = {};
+
+    BOOST_TEST( a1 == a2 );
+    BOOST_TEST_NOT( a1 != a2 );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        a2 = a1;
+        a2[ i ] = 1;
+
+        BOOST_TEST( a1 != a2 );
+        BOOST_TEST_NOT( a1 == a2 );
+    }
+}
+
+// W must take the element loop: its operator== ignores `ignored`, so a
+// bitwise comparison of the storage would give the wrong answer
+
+struct W
+{
+    int v;
+    int ignored;
+};
+
+inline bool operator==( W const& x, W const& y )
+{
+    return x.v == y.v;
+}
+
+inline bool operator!=( W const& x, W const& y )
+{
+    return !( x == y );
+}
+
+void test2()
+{
+    boost::array<W, 2> a1 = {{ { 1, 0 }, { 2, 0 } }};
+    boost::array<W, 2> a2 = {{ { 1, 7 }, { 2, 8 } }};
+
+    BOOST_TEST( a1 == a2 );
+
+    a2[ 1 ].v = 3;
+
+    BOOST_TEST( a1 != a2 );
+}
+
+// floating point must take the element loop as well: -0.0 == 0.0, but
+// the two differ bitwise
+
+template<class T> void test3()
+{
+    boost::array<T, 2> a1 = {{ static_cast<T>( +0.0 ), 1 }};
+    boost::array<T, 2> a2 = {{ static_cast<T>( -0.0 ), 1 }};
+
+    BOOST_TEST( a1 == a2 );
+}
+
+// enumerations must take the element loop: operator== over an
+// enumeration can be user-defined, overriding the builtin comparison
+
+enum E
+{
+    e0, e1, e2
+};
+
+inline bool operator==( E x, E y )
+{
+    // equal when both are e0 or neither is; not a bitwise comparison
+    return ( static_cast<int>( x ) == 0 ) == ( static_cast<int>( y ) == 0 );
+}
+
+inline bool operator!=( E x, E y )
+{
+    return !( x == y );
+}
+
+void test4()
+{
+    boost::array<E, 2> a1 = {{ e0, e1 }};
+    boost::array<E, 2> a2 = {{ e0, e2 }};
+
+    BOOST_TEST( a1 == a2 );
+
+    a2[ 0 ] = e1;
+
+    BOOST_TEST( a1 != a2 );
+}
+
+int main()
+{
+    test<unsigned char, 1>();
+    test<unsigned char, 3>();
+    test<unsigned char, 16>();
+
+    test<int, 1>();
+    test<int, 7>();
+
+    test<long long, 5>();
+
+    test2();
+
+    test3<float>();
+    test3<double>();
+
+    test4();
+
+    return boost::report_errors();
+}
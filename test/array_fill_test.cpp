@@ -47,6 +47,27 @@ template<class T> void test3()
     }
 }
 
+template<class T> void test4()
+{
+    // values whose representation is a single repeated byte
+
+    boost::array<T, 7> a = {};
+
+    a.fill( 0 );
+
+    for( std::size_t i = 0; i < 7; ++i )
+    {
+        BOOST_TEST_EQ( a[i], 0 );
+    }
+
+    a.fill( static_cast<T>( -1 ) );
+
+    for( std::size_t i = 0; i < 7; ++i )
+    {
+        BOOST_TEST_EQ( a[i], static_cast<T>( -1 ) );
+    }
+}
+
 int main()
 {
     test<int, 0>();
@@ -57,5 +78,10 @@ int main()
 
     test3<int>();
 
+    test4<signed char>();
+    test4<short>();
+    test4<int>();
+    test4<long long>();
+
     return boost::report_errors();
 }
@@ -39,6 +39,12 @@ int main()
     RunTests< long >();
     RunTests< long double >();
 
+    // any batched hashing of the contiguous storage has to keep parity
+    // with the per-element hash of the equivalent C array
+
+    RunTests< unsigned char >();
+    RunTests< unsigned int >();
+
     return boost::report_errors();
 }
 
@@ -85,5 +85,8 @@ int main()
     test<int, 1>();
     test<int, 7>();
 
+    test<unsigned char, 1>();
+    test<unsigned char, 7>();
+
     return boost::report_errors();
 }
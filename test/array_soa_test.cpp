@@ -0,0 +1,81 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/array_soa.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+int main()
+{
+    boost::soa_array<4, float, float, int> a = {};
+
+    BOOST_TEST_EQ( a.size(), 4u );
+    BOOST_TEST_EQ( a.columns_size(), 3u );
+    BOOST_TEST_NOT( a.empty() );
+
+    // each column is an ordinary boost::array with contiguous storage
+
+    BOOST_TEST_EQ( a.col<0>().size(), 4u );
+    BOOST_TEST_EQ( a.col<0>().data() + 1, &a.col<0>()[1] );
+    BOOST_TEST_EQ( a.col<2>().data() + 3, &a.col<2>()[3] );
+
+    a.fill( 1.0f, 2.0f, 3 );
+
+    for( std::size_t i = 0; i < 4; ++i )
+    {
+        BOOST_TEST_EQ( a.col<0>()[i], 1.0f );
+        BOOST_TEST_EQ( a.col<1>()[i], 2.0f );
+        BOOST_TEST_EQ( a.col<2>()[i], 3 );
+    }
+
+    a.col<2>()[2] = 7;
+
+    BOOST_TEST_EQ( a.col<2>()[2], 7 );
+    BOOST_TEST_EQ( a.col<2>()[1], 3 );
+
+    {
+        boost::soa_array<4, float, float, int> b = {};
+
+        b.swap( a );
+
+        BOOST_TEST_EQ( b.col<0>()[0], 1.0f );
+        BOOST_TEST_EQ( b.col<2>()[2], 7 );
+        BOOST_TEST_EQ( a.col<2>()[2], 0 );
+
+        boost::swap( a, b );
+
+        BOOST_TEST_EQ( a.col<2>()[2], 7 );
+    }
+
+    {
+        // per-element row access
+
+        boost::soa_array<3, float, int> r = {};
+
+        r.fill( 1.0f, 2 );
+
+        std::get<0>( r[1] ) = 5.0f;
+        std::get<1>( r[1] ) = 6;
+
+        BOOST_TEST_EQ( r.col<0>()[1], 5.0f );
+        BOOST_TEST_EQ( r.col<1>()[1], 6 );
+        BOOST_TEST_EQ( r.col<0>()[0], 1.0f );
+
+        boost::soa_array<3, float, int> const& cr = r;
+
+        BOOST_TEST_EQ( std::get<0>( cr[1] ), 5.0f );
+        BOOST_TEST_EQ( std::get<1>( cr[2] ), 2 );
+    }
+
+    {
+        // const access
+
+        boost::soa_array<2, int> const c = {};
+
+        BOOST_TEST_EQ( c.col<0>()[0], 0 );
+        BOOST_TEST_EQ( c.col<0>()[1], 0 );
+    }
+
+    return boost::report_errors();
+}
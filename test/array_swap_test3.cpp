@@ -0,0 +1,68 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <string>
+
+// exercises the bytewise swap path with sizes around and above
+// its internal block size, and the element-wise fallback
+
+template<class T, std::size_t N> void test()
+{
+    boost::array<T, N> a1, a2;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        a1[i] = static_cast<T>( i );
+        a2[i] = static_cast<T>( i + N );
+    }
+
+    a1.swap( a2 );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( a1[i], static_cast<T>( i + N ) );
+        BOOST_TEST_EQ( a2[i], static_cast<T>( i ) );
+    }
+
+    a1.swap( a1 ); // self-swap
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( a1[i], static_cast<T>( i + N ) );
+    }
+}
+
+void test2()
+{
+    // non-trivial element type takes the element-wise path
+
+    boost::array<std::string, 3> a1 = {{ "a", "b", "c" }};
+    boost::array<std::string, 3> a2 = {{ "d", "e", "f" }};
+
+    a1.swap( a2 );
+
+    BOOST_TEST_EQ( a1[0], "d" );
+    BOOST_TEST_EQ( a1[2], "f" );
+    BOOST_TEST_EQ( a2[0], "a" );
+    BOOST_TEST_EQ( a2[2], "c" );
+}
+
+int main()
+{
+    test<unsigned char, 255>();
+    test<unsigned char, 256>();
+    test<unsigned char, 300>();
+
+    test<int, 64>();
+    test<int, 100>();
+
+    test<double, 64>();
+
+    test2();
+
+    return boost::report_errors();
+}
@@ -92,6 +92,9 @@ int main()
     test<int, 1>();
     test<int, 7>();
 
+    test<unsigned char, 1>();
+    test<unsigned char, 7>();
+
     test<float, 0>();
     test<float, 1>();
     test<float, 7>();
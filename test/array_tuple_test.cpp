@@ -0,0 +1,52 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/array.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_TUPLE)
+
+BOOST_PRAGMA_MESSAGE("Test skipped because BOOST_NO_CXX11_HDR_TUPLE is defined")
+int main() {}
+
+#else
+
+#include <boost/core/lightweight_test.hpp>
+#include <tuple>
+#include <type_traits>
+
+static_assert( std::tuple_size< boost::array<int, 3> >::value == 3, "tuple_size" );
+static_assert( std::tuple_size< const boost::array<int, 3> >::value == 3, "tuple_size (const)" );
+static_assert( std::tuple_size< boost::array<int, 0> >::value == 0, "tuple_size (empty)" );
+
+static_assert( std::is_same< std::tuple_element<0, boost::array<int, 3> >::type, int >::value, "tuple_element" );
+static_assert( std::is_same< std::tuple_element<2, boost::array<double, 3> >::type, double >::value, "tuple_element" );
+
+int main()
+{
+#if defined(__cpp_structured_bindings)
+
+    boost::array<int, 3> a = {{ 1, 2, 3 }};
+
+    auto [ x, y, z ] = a;
+
+    BOOST_TEST_EQ( x, 1 );
+    BOOST_TEST_EQ( y, 2 );
+    BOOST_TEST_EQ( z, 3 );
+
+    auto& [ p, q, r ] = a;
+
+    p = 5;
+
+    BOOST_TEST_EQ( a[0], 5 );
+    BOOST_TEST_EQ( q, 2 );
+    BOOST_TEST_EQ( r, 3 );
+
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
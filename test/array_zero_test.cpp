@@ -0,0 +1,35 @@
+// Copyright 2026 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt)
+
+// array<T, 0> iterators must be null, not derived from `this`, so that
+// empty-array iteration folds away and sanitizers see no invalid casts
+
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+int main()
+{
+    boost::array<int, 0> a = {{}};
+
+    BOOST_TEST( a.begin() == a.end() );
+    BOOST_TEST( a.cbegin() == a.cend() );
+    BOOST_TEST( a.rbegin() == a.rend() );
+
+    BOOST_TEST( a.data() == static_cast<int*>( 0 ) );
+    BOOST_TEST( a.begin() == static_cast<int*>( 0 ) );
+
+    BOOST_TEST( a.empty() );
+
+    std::size_t n = 0;
+
+    for( boost::array<int, 0>::iterator i = a.begin(); i != a.end(); ++i )
+    {
+        ++n;
+    }
+
+    BOOST_TEST_EQ( n, 0u );
+
+    return boost::report_errors();
+}